@@ -91,6 +91,12 @@ FILENAME [/A-Za-z0-9_#.][\-/A-Za-z0-9_#.]+
 <GE_MODE>"mps"                   {return MP_as_amm_maxprocesssize;}
 <GE_MODE>"automatic_memory_management" |
 <GE_MODE>"amm"                 { yy_push_state(ASK_YN_MODE); return MP_as_automemmanagement;}
+<GE_MODE>"pack_sequences" |
+<GE_MODE>"pss"                 { yy_push_state(ASK_YN_MODE); return MP_as_packsequences;}
+<GE_MODE>"profiling" |
+<GE_MODE>"prof"                { yy_push_state(ASK_YN_MODE); return MP_as_profiling;}
+<GE_MODE>"capture_pass" |
+<GE_MODE>"cap"                 {return MP_as_capturepass;}
 
 <GE_MODE>"clean_tmp_files" |
 <GE_MODE>"ctf"                 { yy_push_state(ASK_YN_MODE); return MP_as_cleanup_tmp_files;}
@@ -561,6 +567,8 @@ FILENAME [/A-Za-z0-9_#.][\-/A-Za-z0-9_#.]+
 <FINALMAP_MODE>"mg"                   {return MP_fm_maxgaps;}
 <FINALMAP_MODE>"clean_end_distance" |
 <FINALMAP_MODE>"ced"                   {return MP_fm_clean_end_dist;}
+<FINALMAP_MODE>"direct_kmer_mapping" |
+<FINALMAP_MODE>"dkm"                   {yy_push_state(ASK_YN_MODE); return MP_fm_directkmermapping;}
 
 <CO_MODE>"analysis" |
 <CO_MODE>"an"                      {BEGIN(CO_VALMODE); return MP_con_analyse_mode;}
@@ -38,6 +38,9 @@ enum { MP_ed_mira_automatic_contig_editing=1000,
        MP_as_automemmanagement,
        MP_as_amm_keeppercentfree,
        MP_as_amm_maxprocesssize,
+       MP_as_packsequences,
+       MP_as_profiling,
+       MP_as_capturepass,
        MP_as_nodateoutput,
        MP_as_bangonthrow,
        MP_as_plen,
@@ -226,6 +229,7 @@ enum { MP_ed_mira_automatic_contig_editing=1000,
        MP_fm_maxmismatches,
        MP_fm_maxgaps,
        MP_fm_clean_end_dist,
+       MP_fm_directkmermapping,
 
        MP_paf_use_emergency_blacklist=6000,
        MP_paf_use_emergency_search_stop,